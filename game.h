@@ -5,6 +5,10 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <stdexcept>
 #include <SFML/Graphics.hpp>
 
 const sf::Color ALIVE_COLOR = sf::Color::Black;
@@ -154,6 +158,16 @@ void AgingCell::computeNextState() {
 }
 
 
+// Parse a rule in format 'BXX/SYYY' into the numbers of live neighbors for becoming alive and for staying alive
+void parseBirthSurvival(const std::string& rule, std::vector<int>& b, std::vector<int>& s) {
+    int b_start = rule.find("B") + 1;
+    int s_start = rule.find("S") + 1;
+    int b_end = rule.find("S") - 2;
+    int s_end = rule.size() - 1;
+    for (int i = b_start; i <= b_end; i++) b.push_back(rule.at(i) - '0');
+    for (int i = s_start; i <= s_end; i++) s.push_back(rule.at(i) - '0');
+}
+
  /*
   * Class representing a rule-based cell that follows the given rule variant of Game of Life.
   */
@@ -168,12 +182,7 @@ private:
 
 // Constructor of RuleBasedCell
 RuleBasedCell::RuleBasedCell(float x, float y, std::string rule) : Cell(x, y){
-    int b_start = rule.find("B") + 1;
-    int s_start = rule.find("S") + 1;
-    int b_end = rule.find("S") - 2;
-    int s_end = rule.size() - 1;
-    for (int i = b_start; i <= b_end; i++) b.push_back(rule.at(i) - '0');
-    for (int i = s_start; i <= s_end; i++) s.push_back(rule.at(i) - '0');
+    parseBirthSurvival(rule, b, s);
 }
 
 // compute the next state of cell for RULE_BASED mode. Only the numbers of cells for remaining alive or becoming alive are different from BASIC mode
@@ -302,14 +311,455 @@ int CustomCell::lcm(int m, int n) {
     return m * n / gcd;
 }
 
+/*
+ * Enum of neighborhood shapes available to the rule engine.
+ */
+enum class Neighborhood {
+    MOORE,          // all cells within the given radius, including diagonals
+    VON_NEUMANN,    // cells within the given manhattan distance
+    HEX,            // hexagonal grid laid on the square grid (NE and SW corners excluded)
+    WEIGHTED        // user-defined offsets with individual weights
+};
+
+/*
+ * Struct that holds a single neighbor location relative to a cell, and how much it adds to the neighbor count.
+ */
+struct NeighborOffset {
+    int dRow;
+    int dCol;
+    int weight;
+};
+
+/*
+ * Struct holding a data-driven rule compiled into a flat lookup table.
+ *
+ * States are numbered from 0 (dead) to numStates - 1. A neighbor in state s adds stateWeight[s] times the weight
+ * of its offset to the neighbor count, and the next state of a cell is next[state * stride + count].
+ * stateValue and stateColor give the CellState and color reported for each state.
+ * Setting a cell in state s to the value assignValues[v] moves it to assignNext[s * assignValues.size() + v],
+ * which lets a state carry hidden information (such as the age of a cell) across setState calls.
+ */
+struct RuleTable {
+    int numStates = 0;
+    int stride = 0;
+    std::vector<NeighborOffset> offsets;
+    std::vector<int> stateWeight;
+    std::vector<CellState> stateValue;
+    std::vector<sf::Color> stateColor;
+    std::vector<unsigned char> next;
+    std::vector<CellState> assignValues;
+    std::vector<unsigned char> assignNext;
+
+    void setNext(int state, int count, int nextState) { next[state * stride + count] = static_cast<unsigned char>(nextState); }
+    int maxCount() const { return stride - 1; }
+    int assign(int state, CellState value) const;
+};
+
+// return the state a cell in the given state moves to when it is set to the given value, or -1 if the rule has no such value
+int RuleTable::assign(int state, CellState value) const {
+    for (size_t v = 0; v < assignValues.size(); v++) if (assignValues[v] == value) return assignNext[state * assignValues.size() + v];
+    return -1;
+}
+
+// Build the offsets of the given neighborhood shape with the given radius. Every offset has weight 1.
+std::vector<NeighborOffset> makeNeighborhood(Neighborhood shape, int radius) {
+    std::vector<NeighborOffset> offsets;
+    for (int dr = -radius; dr <= radius; dr++) {
+        for (int dc = -radius; dc <= radius; dc++) {
+            if (dr == 0 && dc == 0) continue;
+            if (shape == Neighborhood::VON_NEUMANN && std::abs(dr) + std::abs(dc) > radius) continue;
+            if (shape == Neighborhood::HEX && std::abs(dr - dc) > radius) continue;
+            offsets.push_back({ dr, dc, 1 });
+        }
+    }
+    return offsets;
+}
+
+// Make a table whose every state stays unchanged regardless of its neighbors, and where setting a cell to
+// a value always moves it to the state with that value. Returns false if the neighbor count cannot be tabulated.
+bool makeRuleTable(int numStates, const std::vector<NeighborOffset>& offsets, const std::vector<int>& stateWeight, RuleTable& table) {
+    if (numStates < 2 || numStates > 256 || static_cast<int>(stateWeight.size()) != numStates) return false;
+    long long offsetSum = 0;
+    int maxWeight = 0;
+    for (const NeighborOffset& o : offsets) {
+        if (o.weight < 0) return false;
+        offsetSum += o.weight;
+    }
+    for (int w : stateWeight) {
+        if (w < 0) return false;
+        maxWeight = std::max(maxWeight, w);
+    }
+    if (offsetSum * maxWeight > 65535) return false;
+
+    table.numStates = numStates;
+    table.stride = static_cast<int>(offsetSum * maxWeight) + 1;
+    table.offsets = offsets;
+    table.stateWeight = stateWeight;
+    table.stateValue.clear();
+    table.stateColor.clear();
+    table.next.assign(numStates * table.stride, 0);
+    for (int s = 0; s < numStates; s++) {
+        table.stateValue.push_back(static_cast<CellState>(s));
+        // live cells are drawn black, and the remaining states fade from gray towards the background
+        int level = s <= 2 ? 100 : 100 + (s - 2) * 120 / std::max(1, numStates - 3);
+        table.stateColor.push_back(s == 1 ? ALIVE_COLOR : sf::Color(level, level, level));
+        for (int c = 0; c < table.stride; c++) table.setNext(s, c, s);
+    }
+    table.assignValues = table.stateValue;
+    table.assignNext.clear();
+    for (int s = 0; s < numStates; s++) for (int v = 0; v < numStates; v++) table.assignNext.push_back(static_cast<unsigned char>(v));
+    return true;
+}
+
+// Parse a list of neighbor counts. Single digits are read one by one ("23"), while lists containing commas
+// or dashes also accept multi-digit counts and ranges ("3,10-12") for neighborhoods larger than 9 cells.
+bool parseCountList(const std::string& text, std::vector<int>& counts) {
+    if (text.find(',') == std::string::npos && text.find('-') == std::string::npos) {
+        for (char ch : text) {
+            if (!std::isdigit(static_cast<unsigned char>(ch))) return false;
+            counts.push_back(ch - '0');
+        }
+        return true;
+    }
+    int low = -1, value = -1;
+    for (size_t i = 0; i <= text.size(); i++) {
+        char ch = i < text.size() ? text[i] : ',';
+        if (std::isdigit(static_cast<unsigned char>(ch))) {
+            value = (value < 0 ? 0 : value * 10) + (ch - '0');
+            if (value > 65535) return false;
+        }
+        else if (ch == '-' && value >= 0 && low < 0) {
+            low = value;
+            value = -1;
+        }
+        else if (ch == ',' && value >= 0) {
+            if (low < 0) low = value;
+            if (low > value) return false;
+            for (int c = low; c <= value; c++) counts.push_back(c);
+            low = value = -1;
+        }
+        else return false;
+    }
+    return true;
+}
+
+// Parse a Generations rule in format 'BXX/SYY/CN', optionally followed by '/NM', '/NN' or '/NH' to choose the
+// Moore, von Neumann or hexagonal neighborhood and '/RN' to choose its radius, and compile it into the given table.
+// State 1 is alive, and a live cell that does not survive decays through states 2 to N - 1 before becoming dead.
+bool parseGenerationsRule(const std::string& rule, RuleTable& table) {
+    std::vector<std::string> parts;
+    size_t start = 0;
+    while (true) {
+        size_t slash = rule.find('/', start);
+        parts.push_back(rule.substr(start, slash - start));
+        if (slash == std::string::npos) break;
+        start = slash + 1;
+    }
+    if (parts.size() < 2 || parts[0].empty() || parts[0][0] != 'B' || parts[1].empty() || parts[1][0] != 'S') return false;
+
+    std::vector<int> birth, survive;
+    if (!parseCountList(parts[0].substr(1), birth) || !parseCountList(parts[1].substr(1), survive)) return false;
+    int numStates = 2, radius = 1;
+    Neighborhood shape = Neighborhood::MOORE;
+    for (size_t i = 2; i < parts.size(); i++) {
+        const std::string& part = parts[i];
+        if (part == "NM") shape = Neighborhood::MOORE;
+        else if (part == "NN") shape = Neighborhood::VON_NEUMANN;
+        else if (part == "NH") shape = Neighborhood::HEX;
+        else if (part.size() >= 2 && part.size() <= 4 && (part[0] == 'C' || part[0] == 'R')) {
+            int value = 0;
+            for (size_t j = 1; j < part.size(); j++) {
+                if (!std::isdigit(static_cast<unsigned char>(part[j]))) return false;
+                value = value * 10 + (part[j] - '0');
+            }
+            if (part[0] == 'C') numStates = value;
+            else radius = value;
+        }
+        else return false;
+    }
+    if (radius < 1 || radius > 10) return false;
+
+    std::vector<int> stateWeight(std::max(numStates, 0), 0);
+    if (numStates >= 2) stateWeight[1] = 1;
+    if (!makeRuleTable(numStates, makeNeighborhood(shape, radius), stateWeight, table)) return false;
+    for (int c : birth) if (c > table.maxCount()) return false;
+    for (int c : survive) if (c > table.maxCount()) return false;
+
+    int dying = numStates > 2 ? 2 : 0;
+    for (int c = 0; c <= table.maxCount(); c++) {
+        table.setNext(0, c, 0);
+        table.setNext(1, c, dying);
+        for (int s = 2; s < numStates; s++) table.setNext(s, c, s + 1 < numStates ? s + 1 : 0);
+    }
+    for (int c : birth) table.setNext(0, c, 1);
+    for (int c : survive) table.setNext(1, c, 1);
+    return true;
+}
+
+/*
+ * Class that evaluates a RuleTable on a whole grid of cells stored as a flat array of states.
+ *
+ * Instead of visiting the neighbors of every cell one by one, the neighbor counts of a whole row are accumulated
+ * offset by offset from contiguous rows of neighbor weights, which the compiler can vectorize.
+ * The next state of every cell is then a single lookup into the table.
+ */
+class RuleEngine {
+public:
+    RuleEngine(int rows, int cols, const RuleTable& rule);
+    virtual ~RuleEngine() {}
+    int getStateIndex(int rowIdx, int colIdx) const { return states[rowIdx * numCols + colIdx]; }
+    CellState getState(int rowIdx, int colIdx) const { return table.stateValue[getStateIndex(rowIdx, colIdx)]; }
+    sf::Color getColor(int rowIdx, int colIdx) const { return table.stateColor[getStateIndex(rowIdx, colIdx)]; }
+    bool isAlive(int rowIdx, int colIdx) const { return getState(rowIdx, colIdx) != CellState::DEAD; }
+
+    virtual void initializeCells(const std::vector<CellCoord>& coords);
+    virtual void updateCells();
+    virtual void resetCells();
+protected:
+    int numRows;
+    int numCols;
+    RuleTable table;
+    int cellIndex(int rowIdx, int colIdx) const;
+    std::vector<unsigned char> states;
+    std::vector<unsigned char> nextStates;
+    std::vector<unsigned short> weights;
+    std::vector<unsigned short> counts;
+};
+
+/*
+ * Class representing a rule engine that keeps the neighbor count of every cell between generations.
+ *
+ * When a cell changes state, its weight difference is added to the counts of the cells that see it as a neighbor.
+ * Only the cells whose state or neighbor count changed in the last generation are evaluated again,
+ * because every other cell would look up the same entry that kept it in its current state.
+ * The work per generation is therefore proportional to the number of changing cells rather than the grid size.
+ */
+class IncrementalRuleEngine : public RuleEngine {
+public:
+    IncrementalRuleEngine(int rows, int cols, const RuleTable& rule);
+    void initializeCells(const std::vector<CellCoord>& coords);
+    void updateCells();
+    void resetCells();
+private:
+    std::vector<NeighborOffset> watchers;   // where the cells that count a cell as a neighbor are, relative to it
+    std::vector<int> dirty;             // cells to evaluate in the next generation
+    std::vector<unsigned char> isDirty;
+    std::vector<int> changed;
+    std::vector<unsigned char> changedStates;
+
+    void markDirty(int idx);
+    void setCellState(int idx, int newState);
+};
+
+// Constructor of RuleEngine. All cells start dead.
+RuleEngine::RuleEngine(int rows, int cols, const RuleTable& rule)
+    : numRows(rows), numCols(cols), table(rule), states(rows * cols, 0), nextStates(rows * cols, 0), weights(rows * cols, 0), counts(rows * cols, 0) {}
+
+// Set the state of the given cells. States that are not part of the rule are ignored.
+void RuleEngine::initializeCells(const std::vector<CellCoord>& coords) {
+    for (CellCoord a_cell : coords) {
+        unsigned char& state = states[cellIndex(a_cell.row, a_cell.col)];
+        int s = table.assign(state, a_cell.state);
+        if (s >= 0) state = static_cast<unsigned char>(s);
+    }
+}
+
+// Return the index of a cell in the flat state array, throwing std::out_of_range like Grid does for cells outside the grid
+int RuleEngine::cellIndex(int rowIdx, int colIdx) const {
+    if (rowIdx < 0 || rowIdx >= numRows || colIdx < 0 || colIdx >= numCols)
+        throw std::out_of_range("cell (" + std::to_string(rowIdx) + ", " + std::to_string(colIdx) + ") is outside the grid");
+    return rowIdx * numCols + colIdx;
+}
+
+// Compute the next state of all cells through the lookup table, wrapping around the edges of the grid.
+void RuleEngine::updateCells() {
+    const int size = numRows * numCols;
+    for (int i = 0; i < size; i++) weights[i] = static_cast<unsigned short>(table.stateWeight[states[i]]);
+    std::fill(counts.begin(), counts.end(), 0);
+    for (const NeighborOffset& o : table.offsets) {
+        if (o.weight == 0) continue;
+        const unsigned short w = static_cast<unsigned short>(o.weight);
+        // columns [0, split) read their neighbor at j + shift, and the rest wrap around to j + shift - numCols
+        const int shift = ((o.dCol % numCols) + numCols) % numCols;
+        const int split = numCols - shift;
+        for (int i = 0; i < numRows; i++) {
+            const int src = ((i + o.dRow) % numRows + numRows) % numRows;
+            unsigned short* dst = &counts[i * numCols];
+            const unsigned short* row = &weights[src * numCols];
+            for (int j = 0; j < split; j++) dst[j] += w * row[j + shift];
+            for (int j = split; j < numCols; j++) dst[j] += w * row[j - split];
+        }
+    }
+    const int stride = table.stride;
+    const unsigned char* next = table.next.data();
+    for (int i = 0; i < size; i++) nextStates[i] = next[states[i] * stride + counts[i]];
+    states.swap(nextStates);
+}
+
+// Reset all cells to the dead state
+void RuleEngine::resetCells() {
+    for (unsigned char& state : states) state = static_cast<unsigned char>(table.assign(state, CellState::DEAD));
+}
+
+// Constructor of IncrementalRuleEngine. All cells start dead and are evaluated in the first generation.
+IncrementalRuleEngine::IncrementalRuleEngine(int rows, int cols, const RuleTable& rule) : RuleEngine(rows, cols, rule), isDirty(rows * cols, 1) {
+    // every cell starts with all of its neighbors in state 0, which may have a weight of its own
+    int initialCount = 0;
+    for (const NeighborOffset& o : table.offsets) {
+        initialCount += o.weight * table.stateWeight[0];
+        // a cell is the neighbor at offset o of the cell at -o from it, wrapped here into [0, numRows) and [0, numCols)
+        if (o.weight != 0) watchers.push_back({ ((-o.dRow) % numRows + numRows) % numRows, ((-o.dCol) % numCols + numCols) % numCols, o.weight });
+    }
+    std::fill(counts.begin(), counts.end(), static_cast<unsigned short>(initialCount));
+    for (int idx = 0; idx < numRows * numCols; idx++) dirty.push_back(idx);
+}
+
+// Set the state of the given cells. States that are not part of the rule are ignored.
+void IncrementalRuleEngine::initializeCells(const std::vector<CellCoord>& coords) {
+    for (CellCoord a_cell : coords) {
+        int idx = cellIndex(a_cell.row, a_cell.col);
+        int s = table.assign(states[idx], a_cell.state);
+        if (s >= 0) setCellState(idx, s);
+    }
+}
+
+// Evaluate the dirty cells against the current states, then commit the cells that changed.
+void IncrementalRuleEngine::updateCells() {
+    const int stride = table.stride;
+    const unsigned char* next = table.next.data();
+    changed.clear();
+    changedStates.clear();
+    for (int idx : dirty) {
+        isDirty[idx] = 0;
+        unsigned char nextState = next[states[idx] * stride + counts[idx]];
+        if (nextState != states[idx]) {
+            changed.push_back(idx);
+            changedStates.push_back(nextState);
+        }
+    }
+    dirty.clear();
+    for (size_t k = 0; k < changed.size(); k++) setCellState(changed[k], changedStates[k]);
+}
+
+// Reset all cells to the dead state
+void IncrementalRuleEngine::resetCells() {
+    for (int idx = 0; idx < numRows * numCols; idx++) {
+        int s = table.assign(states[idx], CellState::DEAD);
+        if (s != states[idx]) setCellState(idx, s);
+    }
+}
+
+// Add the given cell to the cells evaluated in the next generation
+void IncrementalRuleEngine::markDirty(int idx) {
+    if (isDirty[idx]) return;
+    isDirty[idx] = 1;
+    dirty.push_back(idx);
+}
+
+// Change the state of a cell, and apply the difference in its weight to the counts of the cells watching it
+void IncrementalRuleEngine::setCellState(int idx, int newState) {
+    int delta = table.stateWeight[newState] - table.stateWeight[states[idx]];
+    states[idx] = static_cast<unsigned char>(newState);
+    markDirty(idx);
+    if (delta == 0) return;
+    const int row = idx / numCols;
+    const int col = idx % numCols;
+    for (const NeighborOffset& w : watchers) {
+        int watcherRow = row + w.dRow;
+        int watcherCol = col + w.dCol;
+        if (watcherRow >= numRows) watcherRow -= numRows;
+        if (watcherCol >= numCols) watcherCol -= numCols;
+        int watcher = watcherRow * numCols + watcherCol;
+        counts[watcher] = static_cast<unsigned short>(counts[watcher] + delta * w.weight);
+        markDirty(watcher);
+    }
+}
+
    /*
-* Enum of four available game modes.
+* Enum of available game modes.
 */
 enum class GameMode {
     BASIC = 1,
     AGING,
     RULE_BASED,
-    CUSTOM
+    CUSTOM,
+    GENERATIONS,
+    TABLE
+};
+
+// Compile the rule of a game mode played with Cell classes into a table that behaves exactly like those cells,
+// including the age and color an AgingCell keeps when it is reset. Returns false for CUSTOM mode, whose cells
+// count every color separately and cannot be described by a single neighbor count.
+bool compileGameMode(GameMode mode, const std::string& rule, RuleTable& table) {
+    std::vector<NeighborOffset> moore = makeNeighborhood(Neighborhood::MOORE, 1);
+    if (mode == GameMode::BASIC || mode == GameMode::RULE_BASED) {
+        std::vector<int> b, s;
+        if (mode == GameMode::BASIC) {
+            b = { 3 };
+            s = { 2, 3 };
+        }
+        else parseBirthSurvival(rule, b, s);
+        makeRuleTable(2, moore, { 0, 1 }, table);
+        for (int c = 0; c <= table.maxCount(); c++) {
+            table.setNext(0, c, find(b.begin(), b.end(), c) != b.end() ? 1 : 0);
+            table.setNext(1, c, find(s.begin(), s.end(), c) != s.end() ? 1 : 0);
+        }
+        return true;
+    }
+    if (mode == GameMode::AGING) {
+        // each state is a visible state together with the age of the cell (capped at 4, after which it never
+        // turns old) and whether its color is OLD_COLOR, since AgingCell keeps both when it is set to DEAD
+        const CellState values[3] = { CellState::DEAD, CellState::ALIVE, CellState::OLD };
+        auto index = [](int v, int age, int old) { return (v * 5 + age) * 2 + old; };
+        std::vector<int> stateWeight;
+        for (int v = 0; v < 3; v++) for (int i = 0; i < 10; i++) stateWeight.push_back(v == 0 ? 0 : 1);
+        makeRuleTable(30, moore, stateWeight, table);
+        table.assignValues.assign(values, values + 3);
+        table.assignNext.assign(30 * 3, 0);
+        for (int v = 0; v < 3; v++) {
+            for (int age = 0; age < 5; age++) {
+                for (int old = 0; old < 2; old++) {
+                    int s = index(v, age, old);
+                    table.stateValue[s] = values[v];
+                    table.stateColor[s] = old ? OLD_COLOR : ALIVE_COLOR;
+                    table.assignNext[s * 3 + 0] = static_cast<unsigned char>(index(0, age, old));
+                    table.assignNext[s * 3 + 1] = static_cast<unsigned char>(index(1, age, 0));
+                    table.assignNext[s * 3 + 2] = static_cast<unsigned char>(index(2, age, 1));
+                    for (int c = 0; c <= table.maxCount(); c++) {
+                        bool alive = v != 0;
+                        int nextAge = alive ? std::min(age + 1, 4) : age;
+                        int nextOld = old;
+                        int nextV;
+                        if (alive && (c < 2 || c > 3)) nextV = 0;
+                        else if (!alive && c == 3) nextV = 1;
+                        else if (v == 2) nextV = 0;
+                        else nextV = v;
+                        if (nextV == 0) {
+                            nextAge = 0;
+                            nextOld = 0;
+                        }
+                        if (nextV == 1 && nextAge == 3) {
+                            nextV = 2;
+                            nextOld = 1;
+                        }
+                        table.setNext(s, c, index(nextV, nextAge, nextOld));
+                    }
+                }
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+/*
+ * Enum of engines that can run a grid. CUSTOM mode always uses its Cell class, and the GENERATIONS and TABLE modes,
+ * which have no Cell class, use the flat engine when CELLS is chosen.
+ */
+enum class EngineType {
+    FLAT,           // recount every cell each generation (RuleEngine)
+    INCREMENTAL,    // maintain neighbor counts and only revisit changed cells (IncrementalRuleEngine)
+    CELLS           // one Cell object per square, as the reference for the engines
 };
 
 /*
@@ -333,6 +783,8 @@ struct GameConfig {
     int numCols = 10;
     GameMode gameMode = GameMode::BASIC;
     std::string gameRule = "";
+    RuleTable ruleTable;  // rule of GENERATIONS and TABLE modes, which is compiled from the game mode for the others
+    EngineType engineType = EngineType::FLAT;
     sf::Color gridLineColor = sf::Color(200, 200, 200);
     float gridLineThickness = 1.0;
 };
@@ -350,12 +802,14 @@ public:
     void updateCells(); /* TODO */
     void resetCells(); /* TODO */
     const Cell* getCell(int rowIdx, int colIdx) const { return cells.at(rowIdx).at(colIdx); }
+    const RuleEngine* getEngine() const { return engine; }
 
     // Draw the cells on given window
     void drawOn(sf::RenderWindow& window) const;
 private:
     GameConfig config;
     std::vector<std::vector<Cell*>> cells;
+    RuleEngine* engine = NULL;  // used instead of cells unless the game mode needs Cell objects
 };
 
 // Helper functions to compute grid-related dimensions from game configuration
@@ -366,6 +820,13 @@ float getCellHeight(const GameConfig& config);
 
 // Construct a Grid class and dynamically allocate cells.
 Grid::Grid(const GameConfig& cfg): config(cfg) {
+    RuleTable table = cfg.ruleTable;
+    bool hasTable = config.gameMode == GameMode::GENERATIONS || config.gameMode == GameMode::TABLE;
+    if (hasTable || (config.engineType != EngineType::CELLS && compileGameMode(config.gameMode, config.gameRule, table))) {
+        if (config.engineType == EngineType::INCREMENTAL) engine = new IncrementalRuleEngine(cfg.numRows, cfg.numCols, table);
+        else engine = new RuleEngine(cfg.numRows, cfg.numCols, table);
+        return;
+    }
     std::vector<std::vector<std::pair<int, int>*>> neighbors;
     for (int i = 0; i < cfg.numRows; i++) {
         std::vector<Cell*> col;
@@ -426,22 +887,36 @@ Grid::~Grid() {
             a_cell = NULL;
         }
     }
+    delete engine;
+    engine = NULL;
 }
 
 // Initialize starting cell states using given initial cell configuration
 void Grid::initializeCells(const std::vector<CellCoord>& coords) {
+    if (engine != NULL) {
+        engine->initializeCells(coords);
+        return;
+    }
     for (CellCoord a_cell : coords) cells.at(a_cell.row).at(a_cell.col)->setState(a_cell.state);
     
 }
 
 // Compute the future state after a single step, and update into the computed future state for all cells.
 void Grid::updateCells() {
+    if (engine != NULL) {
+        engine->updateCells();
+        return;
+    }
     for (std::vector<Cell*> a_row : cells) for (Cell* a_cell : a_row) a_cell->computeNextState();
     for (std::vector<Cell*> a_row : cells) for (Cell* a_cell : a_row) a_cell->update();
 }
 
 // Reset the state to dead state on all cells
 void Grid::resetCells() {
+    if (engine != NULL) {
+        engine->resetCells();
+        return;
+    }
     for (std::vector<Cell*> a_row : cells) {
         for (Cell* a_cell : a_row) a_cell->setState(CellState::DEAD);
     }
@@ -477,6 +952,18 @@ void Grid::drawOn(sf::RenderWindow& window) const {
             }
         }
     }
+    else if (engine != NULL) {
+        for (int i = 0; i < config.numRows; i++) {
+            for (int j = 0; j < config.numCols; j++) {
+                if (engine->isAlive(i, j)) {
+                    sf::RectangleShape rect(sf::Vector2f(getCellWidth(config), getCellHeight(config)));
+                    rect.setPosition(sf::Vector2f(config.marginSize + j * getCellWidth(config), config.marginSize + i * getCellHeight(config)));
+                    rect.setFillColor(engine->getColor(i, j));
+                    window.draw(rect);
+                }
+            }
+        }
+    }
 
     // Draw grid lines
     for (int i = 0; i <= config.numRows; i++) {  // horizontal lines
@@ -631,6 +1118,12 @@ void GameManager::drawInterface() {
     case GameMode::CUSTOM:
         gameModeName = "CUSTOM";
         break;
+    case GameMode::GENERATIONS:
+        gameModeName = "GENERATIONS(" + config.gameRule + ")";
+        break;
+    case GameMode::TABLE:
+        gameModeName = "TABLE(" + std::to_string(config.ruleTable.numStates) + " states)";
+        break;
     }
     sf::Text rightBottomText("MODE: " + gameModeName, textFont, config.fontSize);
     auto rbBounds = rightBottomText.getLocalBounds();
@@ -6,6 +6,89 @@
 #include "Game.h"
 
 
+// Read a user-defined transition table in the following format, and compile it into the given table.
+//   NUM_STATES NEIGHBORHOOD RADIUS           (NEIGHBORHOOD is MOORE, VON_NEUMANN or HEX, RADIUS is 1 to 10)
+//   NUM_STATES WEIGHTED NUM_OFFSETS          (followed by NUM_OFFSETS lines of 'dRow dCol weight', at most 1000,
+//                                             with offsets no larger than the grid)
+//   WEIGHT_0 ... WEIGHT_{NUM_STATES-1}        (how much a neighbor in each state adds to the count)
+//   NUM_TRANSITIONS                          (followed by NUM_TRANSITIONS lines of 'state count nextState')
+// Transitions that are not given keep the current state.
+void readRuleTable(std::ifstream& infile, GameConfig& config) {
+    RuleTable& table = config.ruleTable;
+    int numStates = 0, size = 0;
+    std::string shape;
+    infile >> numStates >> shape >> size;
+    if (!infile || numStates < 2 || numStates > 256) {
+        std::cout << "Expected number of states between 2 and 256, found: " << numStates << std::endl;
+        exit(1);
+    }
+    std::vector<NeighborOffset> offsets;
+    if (shape == "MOORE" && size >= 1 && size <= 10)
+        offsets = makeNeighborhood(Neighborhood::MOORE, size);
+    else if (shape == "VON_NEUMANN" && size >= 1 && size <= 10)
+        offsets = makeNeighborhood(Neighborhood::VON_NEUMANN, size);
+    else if (shape == "HEX" && size >= 1 && size <= 10)
+        offsets = makeNeighborhood(Neighborhood::HEX, size);
+    else if (shape == "WEIGHTED" && size >= 1 && size <= 1000) {
+        for (int i = 0; i < size; i++) {
+            NeighborOffset o = { 0, 0, 0 };
+            if (!(infile >> o.dRow >> o.dCol >> o.weight) || std::abs(o.dRow) > config.numRows || std::abs(o.dCol) > config.numCols) {
+                std::cout << "Invalid neighbor offset " << i + 1 << std::endl;
+                exit(1);
+            }
+            offsets.push_back(o);
+        }
+    }
+    else {
+        std::cout << "Expected neighborhood MOORE, VON_NEUMANN or HEX with radius 1 to 10, or WEIGHTED with 1 to 1000 offsets, found: " << shape << " " << size << std::endl;
+        exit(1);
+    }
+
+    std::vector<int> stateWeight(numStates);
+    for (int& w : stateWeight) infile >> w;
+    if (!infile || !makeRuleTable(numStates, offsets, stateWeight, table)) {
+        std::cout << "Invalid transition table header with " << numStates << " states" << std::endl;
+        exit(1);
+    }
+
+    int numTransitions = 0;
+    if (!(infile >> numTransitions) || numTransitions < 0) {
+        std::cout << "Expected number of transitions after the state weights" << std::endl;
+        exit(1);
+    }
+    for (int i = 0; i < numTransitions; i++) {
+        int state = 0, count = 0, nextState = 0;
+        infile >> state >> count >> nextState;
+        if (!infile || state < 0 || state >= numStates || count < 0 || count > table.maxCount() || nextState < 0 || nextState >= numStates) {
+            std::cout << "Invalid transition " << i + 1 << ": " << state << " " << count << " " << nextState << std::endl;
+            exit(1);
+        }
+        table.setNext(state, count, nextState);
+    }
+    std::cout << "Number of transitions:        " << numTransitions << std::endl;
+}
+
+
+// Read the optional engine name that may follow the game mode and its rule: FLAT (default), INCREMENTAL or CELLS
+void readEngineType(std::ifstream& infile, GameConfig& config) {
+    infile >> std::ws;
+    if (!std::isalpha(infile.peek())) return;
+    std::string engine;
+    infile >> engine;
+    if (engine == "FLAT")
+        config.engineType = EngineType::FLAT;
+    else if (engine == "INCREMENTAL")
+        config.engineType = EngineType::INCREMENTAL;
+    else if (engine == "CELLS")
+        config.engineType = EngineType::CELLS;
+    else {
+        std::cout << "Unknown engine: " << engine << std::endl;
+        exit(1);
+    }
+    std::cout << "Engine:                       " << engine << std::endl;
+}
+
+
 void readConfigFile(const std::string& fileName, GameConfig& config, std::vector<CellCoord>& initialCoords) {
     std::ifstream infile(fileName);
 
@@ -23,6 +106,10 @@ void readConfigFile(const std::string& fileName, GameConfig& config, std::vector
             config.gameMode = GameMode::RULE_BASED;
         else if (mode == "CUSTOM")
             config.gameMode = GameMode::CUSTOM;
+        else if (mode == "GENERATIONS")
+            config.gameMode = GameMode::GENERATIONS;
+        else if (mode == "TABLE")
+            config.gameMode = GameMode::TABLE;
         else {
             std::cout << "Unknown game mode: " << mode << std::endl;
             exit(1);
@@ -39,6 +126,18 @@ void readConfigFile(const std::string& fileName, GameConfig& config, std::vector
         else if (config.gameMode == GameMode::CUSTOM) {
             // TODO: Tweak game config for custom mode (if you want to)
         }
+        else if (config.gameMode == GameMode::GENERATIONS) {
+            infile >> config.gameRule;
+            if (!parseGenerationsRule(config.gameRule, config.ruleTable)) {
+                std::cout << "Expected game rule in format 'BXX/SYY/CN[/NM|/NN|/NH][/RN]', found: " << config.gameRule << std::endl;
+                exit(1);
+            }
+        }
+        else if (config.gameMode == GameMode::TABLE) {
+            readRuleTable(infile, config);
+        }
+        // CUSTOM mode always runs on its Cell class
+        if (config.gameMode != GameMode::CUSTOM) readEngineType(infile, config);
 
         int row, col, stateNum;
         while (infile >> row >> col >> stateNum) {
@@ -54,7 +153,6 @@ void readConfigFile(const std::string& fileName, GameConfig& config, std::vector
     infile.close();
 }
 
-
 int main() {
     // Read configuration file ---------------------------------------------------
     std::cout << "Enter configuration file name: " << std::endl << ">> ";
@@ -0,0 +1,401 @@
+/*
+ * Differential tests of the rule engines against the Cell classes of Game.h
+ *
+ * Random boards are run through the reference Grid (one Cell object per square) and every engine side by side,
+ * stopping at the first cell whose state or color differs. No window is created.
+ */
+#include <iostream>
+#include <random>
+#include <climits>
+#include <cerrno>
+#include "Game.h"
+
+
+// Describe the game mode and rule of a configuration
+std::string describeMode(const GameConfig& config) {
+    std::string name;
+    switch (config.gameMode) {
+    case GameMode::BASIC:
+        name = "BASIC";
+        break;
+    case GameMode::AGING:
+        name = "AGING";
+        break;
+    case GameMode::RULE_BASED:
+        name = "RULE_BASED " + config.gameRule;
+        break;
+    case GameMode::CUSTOM:
+        name = "CUSTOM";
+        break;
+    case GameMode::GENERATIONS:
+        name = "GENERATIONS " + config.gameRule;
+        break;
+    case GameMode::TABLE:
+        name = "TABLE " + config.gameRule;
+        break;
+    }
+    return name;
+}
+
+// Return the states a random board of the given configuration may start with
+std::vector<CellState> initialStates(const GameConfig& config) {
+    switch (config.gameMode) {
+    case GameMode::AGING:
+        return { CellState::DEAD, CellState::ALIVE, CellState::OLD };
+    case GameMode::CUSTOM:
+        return { CellState::DEAD, CellState::R, CellState::G, CellState::B, CellState::R_AND_G, CellState::G_AND_B,
+                 CellState::B_AND_R, CellState::R_AND_G_AND_B, CellState::OLD };
+    case GameMode::GENERATIONS:
+    case GameMode::TABLE:
+        return config.ruleTable.assignValues;
+    default:
+        return { CellState::DEAD, CellState::ALIVE };
+    }
+}
+
+// Place random states on a random fraction of the grid
+std::vector<CellCoord> randomCoords(std::mt19937& rng, const GameConfig& config) {
+    std::vector<CellState> states = initialStates(config);
+    int density = 1 + rng() % 4;  // out of 8
+    std::vector<CellCoord> coords;
+    for (int i = 0; i < config.numRows; i++) {
+        for (int j = 0; j < config.numCols; j++) {
+            if (static_cast<int>(rng() % 8) < density) coords.push_back({ i, j, states[rng() % states.size()] });
+        }
+    }
+    return coords;
+}
+
+/*
+ * Second implementation of the CUSTOM rule on flat arrays, written independently of CustomCell so that both can be
+ * compared. Besides the state, it keeps the age of every cell and the next state last computed for it, since a
+ * cell keeps both across a reset and reuses its last next state when three or more colors tie for its birth.
+ */
+class CustomModel {
+public:
+    CustomModel(int rows, int cols);
+    CellState getState(int rowIdx, int colIdx) const { return states[rowIdx * numCols + colIdx]; }
+    sf::Color getColor(int rowIdx, int colIdx) const;
+    void initializeCells(const std::vector<CellCoord>& coords);
+    void updateCells();
+    void resetCells();
+private:
+    int numRows;
+    int numCols;
+    std::vector<CellState> states;
+    std::vector<CellState> nextStates;
+    std::vector<int> ages;
+};
+
+// Colors that are counted among the neighbors, in increasing order of their values
+const CellState CUSTOM_COLORS[7] = { CellState::R, CellState::G, CellState::B, CellState::R_AND_G,
+                                     CellState::B_AND_R, CellState::G_AND_B, CellState::R_AND_G_AND_B };
+
+CustomModel::CustomModel(int rows, int cols)
+    : numRows(rows), numCols(cols), states(rows * cols, CellState::DEAD), nextStates(rows * cols, CellState::DEAD), ages(rows * cols, 0) {}
+
+sf::Color CustomModel::getColor(int rowIdx, int colIdx) const {
+    switch (getState(rowIdx, colIdx)) {
+    case CellState::R: return RED;
+    case CellState::G: return GREEN;
+    case CellState::B: return BLUE;
+    case CellState::R_AND_G: return YELLOW;
+    case CellState::G_AND_B: return CYAN;
+    case CellState::B_AND_R: return MAGENTA;
+    case CellState::R_AND_G_AND_B: return BLACK;
+    case CellState::OLD: return OLD_COLOR;
+    default: return sf::Color(0, 0, 0, 0);
+    }
+}
+
+void CustomModel::initializeCells(const std::vector<CellCoord>& coords) {
+    for (CellCoord a_cell : coords) states.at(a_cell.row * numCols + a_cell.col) = a_cell.state;
+}
+
+void CustomModel::resetCells() {
+    std::fill(states.begin(), states.end(), CellState::DEAD);
+}
+
+void CustomModel::updateCells() {
+    for (int i = 0; i < numRows; i++) {
+        for (int j = 0; j < numCols; j++) {
+            int counts[7] = { 0 };
+            for (int di = -1; di <= 1; di++) {
+                for (int dj = -1; dj <= 1; dj++) {
+                    if (di == 0 && dj == 0) continue;
+                    CellState neighbor = states[((i + di + numRows) % numRows) * numCols + (j + dj + numCols) % numCols];
+                    for (int k = 0; k < 7; k++) if (neighbor == CUSTOM_COLORS[k]) counts[k]++;
+                }
+            }
+            int most = *std::max_element(counts, counts + 7);
+            std::vector<CellState> tied;
+            for (int k = 0; k < 7; k++) if (counts[k] == most) tied.push_back(CUSTOM_COLORS[k]);
+
+            int idx = i * numCols + j;
+            CellState state = states[idx];
+            CellState& next = nextStates[idx];
+            int& age = ages[idx];
+            if (std::find(CUSTOM_COLORS, CUSTOM_COLORS + 7, state) != CUSTOM_COLORS + 7) {
+                age++;
+                bool survives = most >= 2 && most <= 4 && std::find(tied.begin(), tied.end(), state) != tied.end();
+                next = !survives ? CellState::DEAD : age == 3 ? CellState::OLD : state;
+            }
+            else if (state == CellState::OLD) next = CellState::DEAD;
+            else if (most == 2 || most == 3) {
+                if (tied.size() == 1) next = tied[0];
+                else if (tied.size() == 2) {
+                    // two tied colors mix into the color whose value is the least common multiple of theirs
+                    int m = static_cast<int>(tied[0]), n = static_cast<int>(tied[1]);
+                    int a = m, b = n;
+                    while (b != 0) {
+                        int r = a % b;
+                        a = b;
+                        b = r;
+                    }
+                    next = static_cast<CellState>(m / a * n);
+                }
+            }
+            else next = state;
+            if (next == CellState::DEAD) age = 0;
+        }
+    }
+    states = nextStates;
+}
+
+// Compare every cell of an engine against the reference grid, and print the first cell that differs.
+template <class Engine>
+bool compareWithGrid(const Grid& grid, const Engine& engine, const GameConfig& config, const std::string& engineName, int generation) {
+    for (int i = 0; i < config.numRows; i++) {
+        for (int j = 0; j < config.numCols; j++) {
+            const RuleEngine* reference = grid.getEngine();
+            CellState expected = reference != NULL ? reference->getState(i, j) : grid.getCell(i, j)->getState();
+            sf::Color expectedColor = reference != NULL ? reference->getColor(i, j) : grid.getCell(i, j)->getColor();
+            CellState found = engine.getState(i, j);
+            sf::Color foundColor = engine.getColor(i, j);
+            // dead cells are not drawn, so only the color of living cells has to match
+            if (found != expected || (expected != CellState::DEAD && foundColor != expectedColor)) {
+                std::cout << "Divergence in " << engineName << " engine at generation " << generation
+                          << ", row " << i + 1 << ", col " << j + 1 << ": expected state " << static_cast<int>(expected)
+                          << " color (" << +expectedColor.r << "," << +expectedColor.g << "," << +expectedColor.b << ")"
+                          << ", found state " << static_cast<int>(found)
+                          << " color (" << +foundColor.r << "," << +foundColor.g << "," << +foundColor.b << ")" << std::endl;
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Run a random board through the reference grid of Cell objects and every engine for the given number of generations.
+// Most boards are also reset and reinitialized every few generations as if R was pressed during the game,
+// since cells keep some of their state across resets. Returns false on the first divergence.
+bool verifyBoard(const GameConfig& config, unsigned int seed, int generations) {
+    std::mt19937 rng(seed);
+    std::vector<CellCoord> coords = randomCoords(rng, config);
+    int resetInterval = rng() % 3 == 0 ? 0 : 2 + rng() % 40;
+
+    // GENERATIONS and TABLE grids run on the flat engine, which the incremental engine is compared against
+    bool hasCells = config.gameMode != GameMode::GENERATIONS && config.gameMode != GameMode::TABLE;
+    RuleTable table = config.ruleTable;
+    std::vector<RuleEngine*> engines;
+    std::vector<std::string> engineNames;
+    if (!hasCells || compileGameMode(config.gameMode, config.gameRule, table)) {
+        if (hasCells) {
+            engines.push_back(new RuleEngine(config.numRows, config.numCols, table));
+            engineNames.push_back("FLAT");
+        }
+        engines.push_back(new IncrementalRuleEngine(config.numRows, config.numCols, table));
+        engineNames.push_back("INCREMENTAL");
+    }
+
+    CustomModel* model = config.gameMode == GameMode::CUSTOM ? new CustomModel(config.numRows, config.numCols) : NULL;
+
+    GameConfig reference = config;
+    reference.engineType = EngineType::CELLS;
+    Grid grid(reference);
+    grid.initializeCells(coords);
+    for (RuleEngine* engine : engines) engine->initializeCells(coords);
+    if (model != NULL) model->initializeCells(coords);
+    bool ok = true;
+    for (int generation = 0; ok && generation <= generations; generation++) {
+        if (resetInterval > 0 && generation > 0 && generation % resetInterval == 0) {
+            grid.resetCells();
+            grid.initializeCells(coords);
+            for (RuleEngine* engine : engines) {
+                engine->resetCells();
+                engine->initializeCells(coords);
+            }
+            if (model != NULL) {
+                model->resetCells();
+                model->initializeCells(coords);
+            }
+        }
+        for (size_t k = 0; ok && k < engines.size(); k++) ok = compareWithGrid(grid, *engines[k], config, engineNames[k], generation);
+        if (ok && model != NULL) ok = compareWithGrid(grid, *model, config, "CUSTOM", generation);
+        if (ok && generation < generations) {
+            grid.updateCells();
+            for (RuleEngine* engine : engines) engine->updateCells();
+            if (model != NULL) model->updateCells();
+        }
+    }
+    if (!ok) std::cout << "  on " << describeMode(config) << " " << config.numRows << "x" << config.numCols << " grid with board seed " << seed << std::endl;
+    for (RuleEngine* engine : engines) delete engine;
+    delete model;
+    return ok;
+}
+
+// Check all engines against the Cell classes on fixed boards of every game mode. Returns the exit code.
+int runVerification(int generations) {
+    std::vector<GameConfig> configs;
+    GameConfig config;
+    config.gameMode = GameMode::BASIC;
+    configs.push_back(config);
+    config.gameMode = GameMode::AGING;
+    configs.push_back(config);
+    config.gameMode = GameMode::CUSTOM;
+    configs.push_back(config);
+    for (std::string rule : { "B3/S23", "B36/S23", "B2/S", "B3678/S34678", "B1357/S1357" }) {
+        config.gameMode = GameMode::RULE_BASED;
+        config.gameRule = rule;
+        configs.push_back(config);
+    }
+    for (std::string rule : { "B3/S23", "B2/S/C3", "B2/S34/C6/NH", "B3,10-12/S2-5/C5/NN/R2" }) {
+        config.gameMode = GameMode::GENERATIONS;
+        config.gameRule = rule;
+        if (!parseGenerationsRule(rule, config.ruleTable)) {
+            std::cout << "Invalid rule in verification list: " << rule << std::endl;
+            return 1;
+        }
+        configs.push_back(config);
+    }
+
+    const int sizes[][2] = { { 1, 1 }, { 2, 3 }, { 10, 10 }, { 17, 23 }, { 40, 40 } };
+    for (GameConfig cfg : configs) {
+        int boards = 0;
+        for (const int* size : sizes) {
+            cfg.numRows = size[0];
+            cfg.numCols = size[1];
+            for (unsigned int seed = 1; seed <= 4; seed++, boards++) {
+                if (!verifyBoard(cfg, seed, generations)) return 1;
+            }
+        }
+        std::cout << "OK  " << describeMode(cfg) << " (" << boards << " boards)" << std::endl;
+    }
+    return 0;
+}
+
+// Return a list of neighbor counts in the comma-separated form accepted by parseGenerationsRule
+std::string countList(std::mt19937& rng, int maxCount) {
+    std::vector<int> counts;
+    for (int c = 0; c <= maxCount; c++) if (rng() % 4 == 0) counts.push_back(c);
+    if (counts.size() == 1) return std::to_string(counts[0]) + "-" + std::to_string(counts[0]);
+    std::string list;
+    for (size_t i = 0; i < counts.size(); i++) list += (i > 0 ? "," : "") + std::to_string(counts[i]);
+    return list;
+}
+
+// Make a random configuration of any game mode with a random rule. Returns false if the rule was rejected.
+bool randomConfig(std::mt19937& rng, GameConfig& config) {
+    config = GameConfig();
+    config.numRows = 1 + rng() % 40;
+    config.numCols = 1 + rng() % 40;
+    config.gameMode = static_cast<GameMode>(1 + rng() % 6);
+    if (config.gameMode == GameMode::RULE_BASED) {
+        std::string b, s;
+        for (char c = '0'; c <= '8'; c++) {
+            if (rng() % 3 == 0) b += c;
+            if (rng() % 3 == 0) s += c;
+        }
+        config.gameRule = "B" + b + "/S" + s;
+    }
+    else if (config.gameMode == GameMode::GENERATIONS) {
+        const char* shapes[] = { "NM", "NN", "NH" };
+        int shape = rng() % 3;
+        int radius = 1 + rng() % 2;
+        int maxCount = static_cast<int>(makeNeighborhood(static_cast<Neighborhood>(shape), radius).size());
+        config.gameRule = "B" + countList(rng, maxCount) + "/S" + countList(rng, maxCount) + "/C" + std::to_string(2 + rng() % 5)
+                          + "/" + shapes[shape] + "/R" + std::to_string(radius);
+        if (!parseGenerationsRule(config.gameRule, config.ruleTable)) return false;
+    }
+    else if (config.gameMode == GameMode::TABLE) {
+        int numStates = 2 + rng() % 4;
+        std::vector<NeighborOffset> offsets;
+        if (rng() % 2 == 0) offsets = makeNeighborhood(static_cast<Neighborhood>(rng() % 3), 1 + rng() % 2);
+        else {
+            int numOffsets = 1 + rng() % 6;
+            for (int i = 0; i < numOffsets; i++) offsets.push_back({ static_cast<int>(rng() % 5) - 2, static_cast<int>(rng() % 5) - 2, static_cast<int>(rng() % 4) });
+        }
+        std::vector<int> stateWeight;
+        for (int i = 0; i < numStates; i++) stateWeight.push_back(rng() % 3);
+        if (!makeRuleTable(numStates, offsets, stateWeight, config.ruleTable)) return false;
+        for (int s = 0; s < numStates; s++) for (int c = 0; c <= config.ruleTable.maxCount(); c++) config.ruleTable.setNext(s, c, rng() % numStates);
+        config.gameRule = "(" + std::to_string(numStates) + " states, " + std::to_string(offsets.size()) + " offsets)";
+    }
+    return true;
+}
+
+// Fuzzing loop over random game modes, rules, board sizes and seeds. Runs until a divergence when iterations is 0.
+int runFuzzing(int iterations, unsigned int seed, int generations) {
+    std::mt19937 rng(seed);
+    for (int i = 1; iterations == 0 || i <= iterations; i++) {
+        GameConfig config;
+        if (!randomConfig(rng, config)) {
+            std::cout << "Generated rule was rejected: " << describeMode(config) << std::endl
+                      << "  in iteration " << i << " of fuzzing seed " << seed << std::endl;
+            return 1;
+        }
+        unsigned int boardSeed = rng();
+        if (!verifyBoard(config, boardSeed, generations)) {
+            std::cout << "  in iteration " << i << " of fuzzing seed " << seed << std::endl;
+            return 1;
+        }
+        if (i % 100 == 0) std::cout << "OK  " << i << " random boards" << std::endl;
+    }
+    return 0;
+}
+
+
+// Read a positive number from a command-line argument. Returns false if the argument is anything else.
+bool parsePositive(const char* arg, int& value) {
+    char* end;
+    long number = std::strtol(arg, &end, 10);
+    if (end == arg || *end != '\0' || number <= 0 || number > INT_MAX) return false;
+    value = static_cast<int>(number);
+    return true;
+}
+
+
+// Read a fuzzing seed from a command-line argument: any number from 0 to UINT_MAX, so every printed seed can be replayed
+bool parseSeed(const char* arg, unsigned int& value) {
+    if (!std::isdigit(static_cast<unsigned char>(arg[0]))) return false;
+    char* end;
+    errno = 0;
+    unsigned long number = std::strtoul(arg, &end, 10);
+    if (*end != '\0' || errno == ERANGE || number > UINT_MAX) return false;
+    value = static_cast<unsigned int>(number);
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    //   verify [GENERATIONS]                            fixed boards of every game mode (2000 generations each)
+    //   verify --fuzz [ITERATIONS] [SEED] [GENERATIONS] random modes, rules and boards (forever if ITERATIONS is omitted)
+    bool fuzz = argc > 1 && std::string(argv[1]) == "--fuzz";
+    int first = fuzz ? 2 : 1;
+    int maxArgs = fuzz ? 3 : 1;
+    if (argc - first > maxArgs) {
+        std::cout << "Too many arguments" << std::endl;
+        return 1;
+    }
+    int args[3];
+    unsigned int seed = std::random_device()();
+    for (int i = first; i < argc; i++) {
+        bool isSeed = fuzz && i == 3;
+        if (isSeed ? !parseSeed(argv[i], seed) : !parsePositive(argv[i], args[i - first])) {
+            std::cout << "Expected " << (isSeed ? "a seed from 0 to " + std::to_string(UINT_MAX) : "a positive number") << ", found: " << argv[i] << std::endl;
+            return 1;
+        }
+    }
+    if (!fuzz)
+        return runVerification(argc > 1 ? args[0] : 2000);
+    return runFuzzing(argc > 2 ? args[0] : 0, seed, argc > 4 ? args[2] : 500);
+}